@@ -1,11 +1,14 @@
 //  gcc -o baseconv baseconv.c bigint.c   /*-Wall -Wextra -pedantic -std=c99 */
+#define _POSIX_C_SOURCE 200809L // For read() in batch mode, posix_memalign() in column mode
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <errno.h>
 #include <ctype.h> // For isspace, toupper, isdigit, islower
 #include <limits.h>
+#include <unistd.h> // For read, STDIN_FILENO
 #include "bigint.h" // Include our BigInt library
 
 // Author: 8891689
@@ -13,23 +16,129 @@
 // --- Forward declarations for helper functions used in main ---
 bool is_valid_for_base(const char* str, const char* digits);
 bool read_line(char* buffer, size_t size);
+int run_batch(void);
+int run_column(long base, long width);
 
 // --- Base Conversion using BigInt ---
 // (These functions use BigInt but are part of the application logic, not the core BigInt library)
 
+// --- Per-Alphabet Radix Cache ---
+// Everything derived from an alphabet (radix, digit lookup table, chunk powers)
+// is computed once on first use and reused by every later conversion.
+// Entries are only ever appended, and the program is single-threaded.
+
+#define RADIX_CACHE_SIZE 32
+#define RADIX_MAX_CHUNK  31 // 2^31 is the first power of 2 that does not fit in an int
+
+typedef struct {
+    const char* digits;              // Alphabet this entry was built for (a private copy when cached)
+    int radix;                       // strlen(digits)
+    int chunk_len;                   // k: radix digits packed into one int chunk
+    int pow[RADIX_MAX_CHUNK + 1];    // pow[j] = radix^j for j = 0..chunk_len
+    int root;                        // Smallest g with radix = g^root_exp (e.g. 64 -> 2, 27 -> 3)
+    int root_exp;
+    int value[UCHAR_MAX + 1];        // Character -> digit value, -1 if not in alphabet
+} RadixInfo;
+
+static RadixInfo radix_cache[RADIX_CACHE_SIZE];
+static int radix_cache_count = 0;
+
+/*
+ * Fills 'info' with everything derived from the alphabet 'digits' of length 'len' (>= 2).
+ */
+static void build_radix_info(RadixInfo* info, const char* digits, size_t len) {
+    info->digits = digits;
+    info->radix = (int)len;
+
+    // Largest k with radix^k <= INT_MAX, so a chunk fits the int arguments of
+    // multiplyBigIntByInt and divideBigIntByInt.
+    info->chunk_len = 0;
+    info->pow[0] = 1;
+    while (info->chunk_len < RADIX_MAX_CHUNK && info->pow[info->chunk_len] <= INT_MAX / info->radix) {
+        info->pow[info->chunk_len + 1] = info->pow[info->chunk_len] * info->radix;
+        info->chunk_len++;
+    }
+
+    for (int c = 0; c <= UCHAR_MAX; c++) {
+        info->value[c] = -1;
+    }
+    for (size_t d = 0; d < len; d++) {
+        unsigned char c = (unsigned char)digits[d];
+        if (info->value[c] < 0) { // First occurrence wins, as with strchr
+            info->value[c] = (int)d;
+        }
+    }
+    // Same case-insensitive fallback as before: a character that is not in the
+    // alphabet maps to its other-case counterpart if that one is.
+    for (int c = 0; c <= UCHAR_MAX; c++) {
+        if (info->value[c] >= 0) continue;
+        int alt = c;
+        if (islower(c)) alt = toupper(c);
+        else if (isupper(c)) alt = tolower(c);
+        if (alt != c && strchr(digits, alt) != NULL) {
+            info->value[c] = info->value[alt];
+        }
+    }
+
+    // Radices sharing a root can be converted by regrouping digits (see transcode_direct)
+    for (int g = 2; g <= info->radix; g++) {
+        int v = info->radix, e = 0;
+        while (v % g == 0) { v /= g; e++; }
+        if (v == 1) {
+            info->root = g;
+            info->root_exp = e;
+            break;
+        }
+    }
+}
+
+/*
+ * Returns the cached radix information for 'digits', building it on first use.
+ * If the entry cannot be cached (cache full, out of memory), it is built in
+ * 'scratch' instead, which must then outlive the use of the result.
+ * Returns NULL only if the alphabet has fewer than 2 characters.
+ */
+static const RadixInfo* get_radix_info(const char* digits, RadixInfo* scratch) {
+    for (int n = 0; n < radix_cache_count; n++) {
+        if (strcmp(radix_cache[n].digits, digits) == 0) {
+            return &radix_cache[n];
+        }
+    }
+
+    size_t len = strlen(digits);
+    if (len < 2) {
+        return NULL;
+    }
+
+    // Keep a private copy: the caller's alphabet may be a temporary buffer
+    char* digits_copy = (radix_cache_count < RADIX_CACHE_SIZE) ? malloc(len + 1) : NULL;
+    if (!digits_copy) {
+        build_radix_info(scratch, digits, len);
+        return scratch;
+    }
+    memcpy(digits_copy, digits, len + 1);
+
+    RadixInfo* info = &radix_cache[radix_cache_count++];
+    build_radix_info(info, digits_copy, len);
+    return info;
+}
+
 /*
  * Converts BigInt to a string in the specified base.
  * Writes the result to 'out' buffer.
+ * Divides by radix^k once per chunk instead of by radix once per digit.
  */
 void convert_base_bigint(const BigInt *value_ptr, const char* digits, char* out, size_t out_size) {
-    int radix = (int)strlen(digits);
     if (out_size == 0) return;
     out[0] = '\0';
 
-    if (radix < 2) {
+    RadixInfo scratch;
+    const RadixInfo* info = get_radix_info(digits, &scratch);
+    if (!info) {
         fprintf(stderr, "Error: Radix must be at least 2.\n");
         return;
     }
+    int radix = info->radix;
 
     char buf[MAX_DIGITS * 4 + 2];
     size_t i = 0;
@@ -42,24 +151,23 @@ void convert_base_bigint(const BigInt *value_ptr, const char* digits, char* out,
     current_value.negative = false;
 
     if (isBigIntZero(&current_value)) {
-        if (i < sizeof(buf) - 1) {
-            buf[i++] = digits[0];
-        } else {
-            fprintf(stderr, "Error: Temp buffer 'buf' too small for zero.\n");
-            out[0] = '\0';
-            return;
-        }
+        buf[i++] = digits[0];
     } else {
         while (!isBigIntZero(&current_value)) {
-            if (i >= sizeof(buf) - 1) {
-                fprintf(stderr, "Error: Temp buffer 'buf' overflow during conversion.\n");
-                out[0] = '\0';
-                return;
+            int chunk = divideBigIntByInt(&current_value, info->pow[info->chunk_len], &quotient);
+            bool last_chunk = isBigIntZero(&quotient);
+
+            // Emit the chunk's digits least significant first; the final chunk
+            // stops at its highest non-zero digit so no leading zeros appear.
+            for (int j = 0; j < info->chunk_len && (!last_chunk || chunk > 0); j++) {
+                if (i >= sizeof(buf) - 1) {
+                    fprintf(stderr, "Error: Temp buffer 'buf' overflow during conversion.\n");
+                    out[0] = '\0';
+                    return;
+                }
+                buf[i++] = digits[chunk % radix];
+                chunk /= radix;
             }
-
-            initBigInt(&quotient);
-            int remainder = divideBigIntByInt(&current_value, radix, &quotient);
-            buf[i++] = digits[remainder];
             memcpy(&current_value, &quotient, sizeof(BigInt));
         }
     }
@@ -79,88 +187,338 @@ void convert_base_bigint(const BigInt *value_ptr, const char* digits, char* out,
     out[out_idx] = '\0';
 }
 
-void convert_from_base_bigint(const char* str, const char* digits, BigInt* result) {
+/*
+ * Converts a string in the base given by 'digits' to a BigInt.
+ * Packs up to k input digits into one int chunk, then folds it in with a single
+ * result = result * radix^m + chunk step.
+ * Returns false, with 'result' set to 0, on an invalid character or if the
+ * value does not fit in a BigInt (MAX_DIGITS decimal digits).
+ */
+bool convert_from_base_bigint(const char* str, const char* digits, BigInt* result) {
     initBigInt(result);
-    size_t base = strlen(digits);
-    if (base < 2) {
+    RadixInfo scratch;
+    const RadixInfo* info = get_radix_info(digits, &scratch);
+    if (!info) {
         fprintf(stderr, "Error: Base must be at least 2 for conversion from string.\n");
-        return; // Return 0
+        return false; // Return 0
     }
 
-    BigInt current_digit_bigint; // To hold the BigInt value of the current digit
-    // BigInt base_bigint; // Not strictly needed for multiplyBigIntByInt
-    // setBigIntFromInt(&base_bigint, base); // Convert base to BigInt once
+    BigInt chunk_bigint; // To hold the BigInt value of the current chunk
+    BigInt temp_result;
+    int chunk = 0;
+    int chunk_digits = 0;
+
+    for (const char* current_char = str; ; current_char++) {
+        // Fold the pending chunk in when it is full or the input has ended
+        if (chunk_digits > 0 && (chunk_digits == info->chunk_len || *current_char == '\0')) {
+            bool had_value = !isBigIntZero(result);
+            multiplyBigIntByInt(result, info->pow[chunk_digits], &temp_result);
+            setBigIntFromInt(&chunk_bigint, chunk);
+            addBigInt(&temp_result, &chunk_bigint, result);
+            // On capacity overflow the BigInt operations reset their result to 0
+            if ((had_value && isBigIntZero(&temp_result)) ||
+                (isBigIntZero(result) && (had_value || chunk != 0))) {
+                initBigInt(result);
+                return false;
+            }
+            chunk = 0;
+            chunk_digits = 0;
+        }
+        if (*current_char == '\0') break;
 
-    const char* current_char = str;
-    while (*current_char != '\0') {
         // Skip whitespace if necessary (should be handled by read_line, but safe check)
         if (isspace((unsigned char)*current_char)) {
-             current_char++;
              continue;
         }
 
-        // Find the digit's value in the provided 'digits' string
-        const char* ptr = strchr(digits, *current_char);
-        char original_char = *current_char; // Store for error message
+        int digit_val = info->value[(unsigned char)*current_char];
+        if (digit_val < 0) { // Not in the alphabet in either case
+             fprintf(stderr, "Error: Invalid character '%c' in input string '%s' for the given base digits '%s'.\n", *current_char, str, digits);
+             initBigInt(result); // Return 0 on error
+             return false;
+        }
 
-        // Case-insensitive matching logic (as before)
-        if (!ptr) {
-            char alt_char = original_char;
-            if (islower((unsigned char)alt_char)) alt_char = toupper((unsigned char)alt_char);
-            else if (isupper((unsigned char)alt_char)) alt_char = tolower((unsigned char)alt_char);
+        chunk = chunk * info->radix + digit_val;
+        chunk_digits++;
+    }
+    // Sign is not handled here. Assumes positive input strings.
+    return true;
+}
+
+
+// --- Direct Transcoding Between Compatible Radices ---
 
-            if (alt_char != original_char) {
-                 ptr = strchr(digits, alt_char);
+/*
+ * True if both alphabets have radices that are powers of the same root
+ * (2/8/16/32/64, or any alphabet to itself), so transcode_direct can be used.
+ */
+bool can_transcode_direct(const char* from_digits, const char* to_digits) {
+    RadixInfo from_scratch, to_scratch;
+    const RadixInfo* from = get_radix_info(from_digits, &from_scratch);
+    const RadixInfo* to = get_radix_info(to_digits, &to_scratch);
+    return from && to && from->root == to->root;
+}
+
+/*
+ * Converts 'str' from one alphabet to another whose radices share a root,
+ * without a BigInt: each input digit is split into root_exp root-digits and
+ * those are regrouped into output digits. O(n) time, constant extra memory,
+ * and no MAX_DIGITS limit. Writes the result to 'out' buffer.
+ */
+void transcode_direct(const char* str, const char* from_digits, const char* to_digits, char* out, size_t out_size) {
+    if (out_size == 0) return;
+    out[0] = '\0';
+
+    RadixInfo from_scratch, to_scratch;
+    const RadixInfo* from = get_radix_info(from_digits, &from_scratch);
+    const RadixInfo* to = get_radix_info(to_digits, &to_scratch);
+    if (!from || !to || from->root != to->root) {
+        fprintf(stderr, "Error: Radices of '%s' and '%s' cannot be transcoded directly.\n", from_digits, to_digits);
+        return;
+    }
+    int g = from->root;
+    int a = from->root_exp; // Root-digits per input digit
+    int b = to->root_exp;   // Root-digits per output digit
+
+    // First pass: validate and count significant input digits
+    size_t n = 0;
+    for (const char* c = str; *c != '\0'; c++) {
+        if (isspace((unsigned char)*c)) continue;
+        int d = from->value[(unsigned char)*c];
+        if (d < 0) {
+            fprintf(stderr, "Error: Invalid character '%c' in input string '%s' for the given base digits '%s'.\n", *c, str, from_digits);
+            return;
+        }
+        if (d > 0 || n > 0) n++;
+    }
+
+    // Pad with leading zero root-digits so the total splits evenly into output digits
+    size_t total = n * (size_t)a;
+    int acc = 0;
+    int acc_len = (int)((b - (int)(total % (size_t)b)) % b);
+    size_t out_idx = 0;
+
+    int top = 1; // g^(a-1), weight of an input digit's most significant root-digit
+    for (int j = 1; j < a; j++) top *= g;
+
+    // Second pass: regroup root-digits into output digits, most significant first
+    bool started = false;
+    for (const char* c = str; *c != '\0'; c++) {
+        if (isspace((unsigned char)*c)) continue;
+        int d = from->value[(unsigned char)*c];
+        if (d == 0 && !started) continue; // Leading zero digit
+        started = true;
+
+        for (int div = top; div > 0; div /= g) {
+            acc = acc * g + (d / div) % g;
+            if (++acc_len < b) continue;
+
+            if (acc != 0 || out_idx > 0) { // Skip leading zeros in the output
+                if (out_idx + 1 >= out_size) {
+                    fprintf(stderr, "Error: Output buffer too small.\n");
+                    out[0] = '\0';
+                    return;
+                }
+                out[out_idx++] = to_digits[acc];
             }
+            acc = 0;
+            acc_len = 0;
         }
+    }
 
-        if (!ptr) { // If still not found, it's an invalid character
-             fprintf(stderr, "Error: Invalid character '%c' in input string '%s' for the given base digits '%s'.\n", original_char, str, digits);
-             initBigInt(result); // Return 0 on error
-             return;
+    if (out_idx == 0) { // Zero
+        if (out_size < 2) {
+            fprintf(stderr, "Error: Output buffer too small.\n");
+            return;
         }
-        unsigned int digit_val = ptr - digits;
+        out[out_idx++] = to_digits[0];
+    }
+    out[out_idx] = '\0';
+}
 
-        // result = result * base
-        BigInt temp_result;
-        multiplyBigIntByInt(result, (int)base, &temp_result); // temp_result = result * base
 
-        // Convert digit_val to a BigInt
-        // ***** PREVIOUSLY ERROR LINE 169 *****
-        setBigIntFromInt(&current_digit_bigint, digit_val); // Correct variable name and pass address
+// --- Columnar Decoding ---
 
-        // result = temp_result + current_digit_bigint
-        // ***** PREVIOUSLY ERROR LINE 173 *****
-        addBigInt(&temp_result, &current_digit_bigint, result); // Correct variable name and pass addresses
+/*
+ * Decodes 'n_rows' strings in the alphabet 'digits' straight into a packed
+ * column of 'width'-byte big-endian unsigned integers (row i at
+ * column + i * width), with no BigInt, allocation or formatting per row.
+ * Bit i of 'validity' (least significant bit first, (n_rows + 7) / 8 bytes)
+ * is set if row i is non-empty, consists only of characters in 'input_set'
+ * (as checked by is_valid_for_base, so no whitespace) and fits in 'width'
+ * bytes; rejected rows are zero-filled. For best throughput 'column' should
+ * be cache-line aligned. Returns the number of valid rows.
+ */
+size_t decode_column(const char* const* rows, size_t n_rows, const char* digits, const char* input_set,
+                     size_t width, unsigned char* column, unsigned char* validity) {
+    memset(validity, 0, (n_rows + 7) / 8);
+    memset(column, 0, n_rows * width);
+
+    RadixInfo scratch;
+    const RadixInfo* info = get_radix_info(digits, &scratch);
+    if (!info || width == 0) {
+        fprintf(stderr, "Error: Column decoding needs a base of at least 2 and a non-zero width.\n");
+        return 0;
+    }
 
-        current_char++;
+    // Characters accepted in a row; each must also map to a digit of 'digits'
+    bool allowed[UCHAR_MAX + 1] = { false };
+    for (const char* c = input_set; *c != '\0'; c++) {
+        allowed[(unsigned char)*c] = (info->value[(unsigned char)*c] >= 0);
     }
-    // Sign is not handled here. Assumes positive input strings.
+
+    // Widths up to 8 bytes accumulate in a uint64_t checked against this limit
+    uint64_t limit = (width >= 8) ? UINT64_MAX : (((uint64_t)1 << (8 * width)) - 1);
+    size_t valid_rows = 0;
+
+    for (size_t r = 0; r < n_rows; r++) {
+        unsigned char* slot = column + r * width;
+        uint64_t acc = 0;
+        int chunk = 0;
+        int chunk_digits = 0;
+        bool any_digit = false;
+        bool ok = true;
+
+        for (const char* c = rows[r]; ok; c++) {
+            // Fold the pending chunk in when it is full or the row has ended
+            if (chunk_digits > 0 && (chunk_digits == info->chunk_len || *c == '\0')) {
+                uint64_t mul = (uint64_t)info->pow[chunk_digits];
+                if (width <= 8) {
+                    if ((uint64_t)chunk > limit || acc > (limit - (uint64_t)chunk) / mul) {
+                        ok = false;
+                    }
+                    acc = acc * mul + (uint64_t)chunk;
+                } else {
+                    // slot = slot * radix^m + chunk, one byte at a time from the least significant end
+                    uint64_t carry = (uint64_t)chunk;
+                    for (size_t k = width; k-- > 0; ) {
+                        uint64_t t = slot[k] * mul + carry;
+                        slot[k] = (unsigned char)(t & 0xFF);
+                        carry = t >> 8;
+                    }
+                    if (carry != 0) {
+                        ok = false;
+                    }
+                }
+                chunk = 0;
+                chunk_digits = 0;
+            }
+            if (*c == '\0') break;
+
+            if (!allowed[(unsigned char)*c]) {
+                ok = false;
+                break;
+            }
+            int d = info->value[(unsigned char)*c];
+            chunk = chunk * info->radix + d;
+            chunk_digits++;
+            any_digit = true;
+        }
+
+        if (!ok || !any_digit) {
+            memset(slot, 0, width);
+            continue;
+        }
+        if (width <= 8) {
+            for (size_t k = width; k-- > 0; acc >>= 8) {
+                slot[k] = (unsigned char)(acc & 0xFF);
+            }
+        }
+        validity[r / 8] |= (unsigned char)(1u << (r % 8));
+        valid_rows++;
+    }
+    return valid_rows;
 }
 
 
 // --- Main Application Logic ---
 
 // --- Define Character Sets ---
-const char* digits2  = "01";
-const char* digits8  = "01234567";
-const char* digits10 = "0123456789";
-const char* digits16_upper = "0123456789ABCDEF";
-const char* digits16_lower = "0123456789abcdef";
-const char* digits16_input = "0123456789abcdefABCDEF";
-const char* digits26 = "abcdefghijklmnopqrstuvwxyz";
-const char* digits32 = "0123456789ABCDEFGHJKMNPQRSTVWXYZ";
-const char* digits36_lower = "0123456789abcdefghijklmnopqrstuvwxyz";
-const char* digits36_input = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
-const char* digits52 = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
-const char* digits58 = "123456789abcdefghijkmnopqrstuvwxyzABCDEFGHJKLMNPQRSTUVWXYZ";
-const char* digits62 = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
-const char* digits64_std = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+const char digits2[] = "01";
+const char digits8[] = "01234567";
+const char digits10[] = "0123456789";
+const char digits16_upper[] = "0123456789ABCDEF";
+const char digits16_lower[] = "0123456789abcdef";
+const char digits16_input[] = "0123456789abcdefABCDEF";
+const char digits26[] = "abcdefghijklmnopqrstuvwxyz";
+const char digits32[] = "0123456789ABCDEFGHJKMNPQRSTVWXYZ";
+const char digits36_lower[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+const char digits36_input[] = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+const char digits52[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+const char digits58[] = "123456789abcdefghijkmnopqrstuvwxyzABCDEFGHJKLMNPQRSTUVWXYZ";
+const char digits62[] = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+const char digits64_std[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 // const char* digits64_url = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_"; // Unused currently
 
+// --- Supported Bases ---
+typedef struct {
+    long base;
+    const char* input_set;      // Characters accepted in user input
+    const char* conversion_set; // Alphabet used to compute the value
+    const char* output_set;     // Alphabet used when printing results
+    const char* name;
+    const char* note;           // Extra hint printed after the base prompt, or NULL
+} BaseSpec;
+
+static const BaseSpec base_specs[] = {
+    {  2, digits2,        digits2,        digits2,        "Base 2",              NULL },
+    {  8, digits8,        digits8,        digits8,        "Base 8",              NULL },
+    { 10, digits10,       digits10,       digits10,       "Base 10",             NULL },
+    { 16, digits16_input, digits16_upper, digits16_lower, "Base 16",             "(Input accepts 0-9, a-f, A-F)" },
+    { 26, digits26,       digits26,       digits26,       "Base 26 (a-z)",       NULL },
+    { 32, digits32,       digits32,       digits32,       "Base 32 (Crockford)", NULL },
+    { 36, digits36_input, digits36_lower, digits36_lower, "Base 36",             "(Input accepts 0-9, a-z, A-Z; processed as lowercase)" },
+    { 52, digits52,       digits52,       digits52,       "Base 52 (a-zA-Z)",    NULL },
+    { 58, digits58,       digits58,       digits58,       "Base 58 (Bitcoin)",   NULL },
+    { 62, digits62,       digits62,       digits62,       "Base 62 (0-9a-zA-Z)", NULL },
+    { 64, digits64_std,   digits64_std,   digits64_std,   "Base 64 (Standard)",  "(Using standard Base64 alphabet: A-Z a-z 0-9 + /)" },
+};
 
-int main(void)
+/*
+ * Returns the BaseSpec for 'base', or NULL if the base is not supported.
+ */
+static const BaseSpec* find_base_spec(long base) {
+    for (size_t i = 0; i < sizeof(base_specs) / sizeof(base_specs[0]); i++) {
+        if (base_specs[i].base == base) return &base_specs[i];
+    }
+    return NULL;
+}
+
+
+/*
+ * Converts the value for output, regrouping the input digits directly when the
+ * radices allow it and going through the BigInt otherwise.
+ */
+static void convert_for_output(const BigInt* num, const char* input_str, const char* input_digits,
+                               const char* out_digits, char* out, size_t out_size) {
+    if (can_transcode_direct(input_digits, out_digits)) {
+        transcode_direct(input_str, input_digits, out_digits, out, out_size);
+    } else {
+        convert_base_bigint(num, out_digits, out, out_size);
+    }
+}
+
+
+int main(int argc, char* argv[])
 {
+    if (argc > 1) {
+        if (argc == 2 && (strcmp(argv[1], "-b") == 0 || strcmp(argv[1], "--batch") == 0)) {
+            return run_batch();
+        }
+        if (argc == 4 && strcmp(argv[1], "--column") == 0) {
+            char* endptr;
+            long base = strtol(argv[2], &endptr, 10);
+            bool bad_base = (*endptr != '\0' || endptr == argv[2]);
+            long width = strtol(argv[3], &endptr, 10);
+            bool bad_width = (*endptr != '\0' || endptr == argv[3]);
+            if (!bad_base && !bad_width) {
+                return run_column(base, width);
+            }
+        }
+        fprintf(stderr, "Usage: %s [-b | --batch | --column <base> <width_bytes>]\n", argv[0]);
+        return 1;
+    }
+
     char base_input_buf[20];
     char num_input_buf[MAX_DIGITS * 4];
     char processed_input_buf[MAX_DIGITS * 4];
@@ -193,35 +551,16 @@ int main(void)
         }
 
         // --- Map Base Number to Input Validation Set and Conversion Digits Set ---
-        switch (input_base_num) {
-             case 2:  input_validation_set = digits2; conversion_digits_set = digits2; input_base_name="Base 2"; break;
-             case 8:  input_validation_set = digits8; conversion_digits_set = digits8; input_base_name="Base 8"; break;
-             case 10: input_validation_set = digits10; conversion_digits_set = digits10; input_base_name="Base 10"; break;
-             case 16:
-                  input_validation_set = digits16_input;
-                  conversion_digits_set = digits16_upper; // Normalize to uppercase for conversion
-                  input_base_name = "Base 16";
-                  printf(" (Input accepts 0-9, a-f, A-F)\n");
-                  break;
-             case 26: input_validation_set = digits26; conversion_digits_set = digits26; input_base_name="Base 26 (a-z)"; break;
-             case 32: input_validation_set = digits32; conversion_digits_set = digits32; input_base_name="Base 32 (Crockford)"; break;
-             case 36:
-                  input_validation_set = digits36_input;
-                  conversion_digits_set = digits36_lower; // Normalize to lowercase for conversion
-                  input_base_name="Base 36";
-                  printf(" (Input accepts 0-9, a-z, A-Z; processed as lowercase)\n");
-                  break;
-             case 52: input_validation_set = digits52; conversion_digits_set = digits52; input_base_name="Base 52 (a-zA-Z)"; break;
-             case 58: input_validation_set = digits58; conversion_digits_set = digits58; input_base_name="Base 58 (Bitcoin)"; break;
-             case 62: input_validation_set = digits62; conversion_digits_set = digits62; input_base_name="Base 62 (0-9a-zA-Z)"; break;
-             case 64:
-                 input_validation_set = digits64_std; conversion_digits_set = digits64_std;
-                 input_base_name="Base 64 (Standard)";
-                 printf(" (Using standard Base64 alphabet: A-Z a-z 0-9 + /)\n");
-                 break;
-             default:
-                 fprintf(stderr, "Error: Base %ld selection logic error or base not supported.\n", input_base_num);
-                  conversion_digits_set = NULL;
+        const BaseSpec* spec = find_base_spec(input_base_num);
+        if (!spec) {
+             fprintf(stderr, "Error: Base %ld selection logic error or base not supported.\n", input_base_num);
+             continue;
+        }
+        input_validation_set = spec->input_set;
+        conversion_digits_set = spec->conversion_set; // Case-normalized alphabet for 16 and 36
+        input_base_name = spec->name;
+        if (spec->note) {
+             printf(" %s\n", spec->note);
         }
     }
 
@@ -251,13 +590,16 @@ int main(void)
              for (char *p = processed_input_buf; *p; ++p) { *p = tolower((unsigned char)*p); }
         }
 
+        // --- Convert Processed Input String to BigInt Number ---
+        // Every output line is for the same value, so it must fit in a BigInt
+        if (!convert_from_base_bigint(processed_input_buf, conversion_digits_set, &num)) {
+            fprintf(stderr, "Error: Value exceeds the BigInt capacity of %d decimal digits.\n", MAX_DIGITS);
+            continue;
+        }
+
         valid_num_input = true;
     }
 
-    // --- Convert Processed Input String to BigInt Number ---
-    convert_from_base_bigint(processed_input_buf, conversion_digits_set, &num);
-
-
     // Print the converted BigInt value (in base 10)
     bigIntToString(&num, num_str_decimal, sizeof(num_str_decimal));
     printf("\nInput '%s' (%s) converted to value %s (base 10).\n",
@@ -267,21 +609,21 @@ int main(void)
     // --- Proceed with Conversions to Other Bases (OUTPUT Section) ---
     printf("\nConversion results for value %s (數值轉換結果):\n", num_str_decimal);
 
-    convert_base_bigint(&num, digits2, out_buf, sizeof(out_buf));
+    convert_for_output(&num, processed_input_buf, conversion_digits_set, digits2, out_buf, sizeof(out_buf));
     printf("Base  2 : %s\n", out_buf);
 
-    convert_base_bigint(&num, digits8, out_buf, sizeof(out_buf));
+    convert_for_output(&num, processed_input_buf, conversion_digits_set, digits8, out_buf, sizeof(out_buf));
     printf("Base  8 : %s\n", out_buf);
 
     printf("Base 10 : %s\n", num_str_decimal);
 
-    convert_base_bigint(&num, digits16_lower, out_buf, sizeof(out_buf));
+    convert_for_output(&num, processed_input_buf, conversion_digits_set, digits16_lower, out_buf, sizeof(out_buf));
     printf("Base 16 : %s\n", out_buf);
 
     convert_base_bigint(&num, digits26, out_buf, sizeof(out_buf));
     printf("Base 26 : %s\n", out_buf);
 
-    convert_base_bigint(&num, digits32, out_buf, sizeof(out_buf));
+    convert_for_output(&num, processed_input_buf, conversion_digits_set, digits32, out_buf, sizeof(out_buf));
     printf("Base 32 : %s\n", out_buf);
 
     convert_base_bigint(&num, digits36_lower, out_buf, sizeof(out_buf));
@@ -296,7 +638,7 @@ int main(void)
     convert_base_bigint(&num, digits62, out_buf, sizeof(out_buf));
     printf("Base 62 : %s\n", out_buf);
 
-    convert_base_bigint(&num, digits64_std, out_buf, sizeof(out_buf));
+    convert_for_output(&num, processed_input_buf, conversion_digits_set, digits64_std, out_buf, sizeof(out_buf));
     printf("Base 64 : %s\n", out_buf);
 
     // --- Restoration Checks ---
@@ -317,6 +659,238 @@ int main(void)
 } // End of main
 
 
+// --- Batch Mode ---
+
+#define BATCH_IO_BUF (64 * 1024) // Size of the batch input buffer and the stdout buffer
+
+typedef struct {
+    char buf[BATCH_IO_BUF];
+    size_t start; // First unconsumed byte
+    size_t end;   // One past the last byte read
+    bool eof;
+} LineReader;
+
+/*
+ * Returns the next line from stdin with the newline stripped, or NULL at end of
+ * input or on a read error. Lines longer than the buffer are skipped and
+ * reported through 'too_long'.
+ * Pending output is flushed only right before a read() call, i.e. when every
+ * request received so far has been answered. Bulk input therefore produces a
+ * few large writes, while a client that waits for its answers still gets them.
+ */
+static char* next_line(LineReader* r, bool* too_long) {
+    bool discarding = false;
+    *too_long = false;
+
+    for (;;) {
+        char* newline_pos = memchr(r->buf + r->start, '\n', r->end - r->start);
+        if (newline_pos != NULL) {
+            char* line = r->buf + r->start;
+            *newline_pos = '\0';
+            r->start = (size_t)(newline_pos - r->buf) + 1;
+            if (discarding) {
+                *too_long = true;
+            }
+            return line;
+        }
+
+        if (discarding) { // Drop the middle of an over-long line
+            r->start = r->end = 0;
+        } else if (r->start > 0) { // Move the partial line to the front
+            memmove(r->buf, r->buf + r->start, r->end - r->start);
+            r->end -= r->start;
+            r->start = 0;
+        }
+
+        if (r->eof) {
+            if (r->end > r->start) { // Final line without a newline
+                char* line = r->buf + r->start;
+                r->buf[r->end] = '\0'; // Room is guaranteed: a full buffer is never kept
+                r->start = r->end;
+                return line;
+            }
+            if (discarding) {
+                *too_long = true;
+                return r->buf + r->end;
+            }
+            return NULL;
+        }
+
+        if (r->end == sizeof(r->buf) - 1) { // Full and no newline: keep one byte for '\0'
+            discarding = true;
+            r->start = r->end = 0;
+        }
+
+        fflush(stdout);
+        ssize_t n = read(STDIN_FILENO, r->buf + r->end, sizeof(r->buf) - 1 - r->end);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            perror("read error");
+            return NULL;
+        }
+        if (n == 0) {
+            r->eof = true;
+        }
+        r->end += (size_t)n;
+    }
+}
+
+/*
+ * Non-interactive mode for callers that keep one process open and send many
+ * conversions over a pipe. Each request is one line:
+ *
+ *     <from_base> <to_base> <number>
+ *
+ * and gets exactly one response line: the converted number, or "ERR <reason>".
+ * Empty lines are ignored. Requests can be pipelined; see next_line() for
+ * when responses are flushed.
+ */
+int run_batch(void) {
+    static LineReader reader;
+    static char stdout_buf[BATCH_IO_BUF];
+    static char out_buf[BATCH_IO_BUF * 6]; // Base 64 to base 2 direct transcoding grows 6x
+    BigInt num;
+    char* line_buf;
+    bool too_long;
+
+    setvbuf(stdout, stdout_buf, _IOFBF, sizeof(stdout_buf));
+
+    while ((line_buf = next_line(&reader, &too_long)) != NULL) {
+        if (too_long) {
+            printf("ERR line exceeds %zu bytes\n", sizeof(reader.buf) - 2);
+            continue;
+        }
+
+        char* p = line_buf;
+        while (isspace((unsigned char)*p)) p++;
+        if (*p == '\0') continue;
+
+        char* endptr;
+        errno = 0;
+        long from_base = strtol(p, &endptr, 10);
+        bool bad_from = (errno != 0 || endptr == p || !isspace((unsigned char)*endptr));
+        p = endptr;
+        errno = 0;
+        long to_base = strtol(p, &endptr, 10);
+        bool bad_to = (errno != 0 || endptr == p || !isspace((unsigned char)*endptr));
+        p = endptr;
+
+        // The number runs to the end of the line, minus surrounding whitespace
+        while (isspace((unsigned char)*p)) p++;
+        char* end = p + strlen(p);
+        while (end > p && isspace((unsigned char)end[-1])) end--;
+        *end = '\0';
+
+        const BaseSpec* from_spec = bad_from ? NULL : find_base_spec(from_base);
+        const BaseSpec* to_spec = bad_to ? NULL : find_base_spec(to_base);
+        if (!from_spec || !to_spec) {
+            printf("ERR expected '<from_base> <to_base> <number>' with supported bases\n");
+        } else if (!is_valid_for_base(p, from_spec->input_set)) {
+            printf("ERR invalid character for %s\n", from_spec->name);
+        } else {
+            // The cached digit lookup folds case, so 16/36 input needs no normalizing here
+            if (can_transcode_direct(from_spec->conversion_set, to_spec->output_set)) {
+                transcode_direct(p, from_spec->conversion_set, to_spec->output_set, out_buf, sizeof(out_buf));
+            } else {
+                if (!convert_from_base_bigint(p, from_spec->conversion_set, &num)) {
+                    printf("ERR value exceeds capacity\n");
+                    continue;
+                }
+                convert_base_bigint(&num, to_spec->output_set, out_buf, sizeof(out_buf));
+            }
+            printf("%s\n", out_buf);
+        }
+    }
+
+    fflush(stdout);
+    return reader.eof ? 0 : 1;
+}
+
+
+// --- Column Mode ---
+
+#define COLUMN_BLOCK_ROWS 4096                // Rows decoded per decode_column call
+#define COLUMN_TEXT_BUF   (4 * BATCH_IO_BUF)  // Row text gathered for one block
+#define COLUMN_MAX_WIDTH  256
+
+/*
+ * Reads one encoded value per line from stdin and writes each as a
+ * 'width'-byte big-endian unsigned integer to stdout, for loaders that take
+ * fixed-width binary columns. Rows are decoded in blocks with decode_column.
+ * Rows are held to the same character set as interactive and batch input.
+ * Rejected rows (empty, any other character including whitespace, or too
+ * large for 'width') are written as zeros and reported on stderr by their
+ * 1-based line number.
+ */
+int run_column(long base, long width) {
+    const BaseSpec* spec = find_base_spec(base);
+    if (!spec) {
+        fprintf(stderr, "Error: Base %ld not supported.\n", base);
+        return 1;
+    }
+    if (width < 1 || width > COLUMN_MAX_WIDTH) {
+        fprintf(stderr, "Error: Width must be between 1 and %d bytes.\n", COLUMN_MAX_WIDTH);
+        return 1;
+    }
+
+    static LineReader reader;
+    static char stdout_buf[BATCH_IO_BUF];
+    static char text[COLUMN_TEXT_BUF];
+    static const char* rows[COLUMN_BLOCK_ROWS];
+    unsigned char validity[(COLUMN_BLOCK_ROWS + 7) / 8];
+    unsigned char* column = NULL;
+    if (posix_memalign((void**)&column, 64, (size_t)COLUMN_BLOCK_ROWS * (size_t)width) != 0) {
+        fprintf(stderr, "Error: Could not allocate the column buffer.\n");
+        return 1;
+    }
+
+    setvbuf(stdout, stdout_buf, _IOFBF, sizeof(stdout_buf));
+
+    size_t n_rows = 0;
+    size_t text_len = 0;
+    size_t rows_done = 0; // Rows written in earlier blocks
+    bool at_end = false;
+    bool failed = false;
+
+    while (!at_end) {
+        bool too_long;
+        char* line = next_line(&reader, &too_long);
+        at_end = (line == NULL);
+
+        // Row pointers into 'reader' do not survive the next read, so rows are
+        // copied into 'text' until the block is full
+        size_t line_len = at_end ? 0 : strlen(line);
+        if (n_rows > 0 && (at_end || n_rows == COLUMN_BLOCK_ROWS || text_len + line_len + 1 > sizeof(text))) {
+            decode_column(rows, n_rows, spec->conversion_set, spec->input_set, (size_t)width, column, validity);
+            if (fwrite(column, (size_t)width, n_rows, stdout) != n_rows) {
+                perror("fwrite error");
+                failed = true;
+                break;
+            }
+            for (size_t i = 0; i < n_rows; i++) {
+                if (!(validity[i / 8] & (1u << (i % 8)))) {
+                    fprintf(stderr, "Row %zu: rejected\n", rows_done + i + 1);
+                }
+            }
+            rows_done += n_rows;
+            n_rows = 0;
+            text_len = 0;
+        }
+        if (at_end) break;
+
+        if (too_long) line_len = 0; // Empty row, rejected like any other invalid row
+        memcpy(text + text_len, line, line_len);
+        text[text_len + line_len] = '\0';
+        rows[n_rows++] = text + text_len;
+        text_len += line_len + 1;
+    }
+
+    free(column);
+    if (fflush(stdout) != 0) failed = true;
+    return (failed || !reader.eof) ? 1 : 0;
+}
+
+
 // --- Helper Function Definitions ---
 
 /*
@@ -91,46 +91,46 @@ void setBigIntFromString(BigInt *num, const char *str) {
     }
 
 
-    // Basic validation (allow only digits in the effective part)
-    for(size_t k = digit_start; k < len; k++) { // Use size_t
-        if (!isdigit((unsigned char)str[k])) {
-             fprintf(stderr, "Error: Invalid character '%c' in number string '%s'.\n", str[k], str);
-             initBigInt(num); // Reset to 0 on error
-             return;
-        }
-    }
-
     if (effective_len > MAX_DIGITS) {
         fprintf(stderr, "Error: String representation (length %d) too long for BigInt capacity (%d).\n", effective_len, MAX_DIGITS);
         initBigInt(num); // Reset to 0 on error
         return;
     }
 
-    num->size = effective_len;
-    for (int i = 0; i < effective_len; i++) {
-        // Store digits in reverse order from the effective part of the string
-        num->digits[i] = str[len - 1 - i] - '0';
+    // Validate and store in one pass, digits in reverse order from the effective part of the string
+    int *d = &num->digits[effective_len - 1];
+    for (size_t k = digit_start; k < len; k++) {
+        unsigned char c = (unsigned char)str[k];
+        if (!isdigit(c)) {
+             fprintf(stderr, "Error: Invalid character '%c' in number string '%s'.\n", c, str);
+             initBigInt(num); // Reset to 0 on error
+             return;
+        }
+        *d-- = c - '0';
     }
+    num->size = effective_len;
     // Keep sign from earlier check
 }
 
 
+// Number of characters bigIntToString writes for 'num', excluding the null terminator.
+size_t bigIntStringLength(const BigInt *num) {
+    if (num->size <= 0 || isBigIntZero(num)) return 1; // "0"
+    return (num->negative ? 1 : 0) + (size_t)num->size;
+}
+
+// Formats into one buffer and writes it with a single call instead of one printf per digit.
 void printBigInt(const BigInt *num) {
-    if (num->negative && !isBigIntZero(num)) printf("-"); // Avoid printing "-0"
-    if (num->size == 0) { // Should not happen with proper init, but safe check
-        printf("0");
-        return;
-    }
-    for (int i = num->size - 1; i >= 0; i--) {
-        printf("%d", num->digits[i]);
-    }
+    char buf[MAX_DIGITS + 2]; // Sign, digits and null terminator
+    bigIntToString(num, buf, sizeof(buf));
+    fputs(buf, stdout);
 }
 
 // Modified to accept buffer size
 void bigIntToString(const BigInt *num, char *str, size_t str_size) {
     if (str_size == 0) return; // No space
 
-    if (isBigIntZero(num)) {
+    if (num->size <= 0 || isBigIntZero(num)) {
         if (str_size >= 2) { // Need space for '0' and '\0'
             str[0] = '0';
             str[1] = '\0';
@@ -140,40 +140,28 @@ void bigIntToString(const BigInt *num, char *str, size_t str_size) {
         return;
     }
 
-    size_t k = 0; // Use size_t for index comparison with str_size
-    if (num->negative) {
-        if (k < str_size - 1) { // Check space for '-' and '\0'
-            str[k++] = '-';
-        } else {
-            str[0] = '\0'; // Not enough space
-            return;
-        }
-    }
-
-    // Calculate required length first
-    // Need space for sign (if any), all digits, and null terminator
-    size_t required_len = (num->negative ? 1 : 0) + (size_t)num->size + 1;
+    // Exact length is known up front: sign (if any), all digits, and null terminator
+    size_t required_len = bigIntStringLength(num) + 1;
+    size_t digits_to_write = (size_t)num->size;
     if (required_len > str_size) {
          fprintf(stderr, "Warning: bigIntToString buffer too small (needed %zu, got %zu).\n", required_len, str_size);
-         // Truncate safely - determine max digits we can write
-         size_t max_write_index = str_size - 1; // Last index for non-null char
-         size_t available_for_digits = max_write_index - k; // Space left after sign
-         int num_digits_to_write = (num->size < (int)available_for_digits) ? num->size : (int)available_for_digits;
-
-         for (int i = num->size - 1; i >= num->size - num_digits_to_write; --i) {
-             str[k++] = num->digits[i] + '0';
+         // Truncate safely - keep the most significant digits that fit
+         size_t sign_len = num->negative ? 1 : 0;
+         if (str_size - 1 <= sign_len) {
+             str[0] = '\0'; // Not enough space
+             return;
          }
-         str[k] = '\0'; // Null terminate truncated string
-         return; // Stop here after truncation
+         digits_to_write = str_size - 1 - sign_len;
     }
 
-
-    // If buffer is large enough, write all digits
-    for (int i = num->size - 1; i >= 0; i--) {
-        // We already checked required_len, so k < str_size - 1 is guaranteed here
-        str[k++] = num->digits[i] + '0';
+    // Single pass from the most significant digit
+    char *p = str;
+    if (num->negative) *p++ = '-';
+    const int *d = &num->digits[num->size - 1];
+    for (size_t i = 0; i < digits_to_write; i++) {
+        *p++ = (char)('0' + *d--);
     }
-    str[k] = '\0'; // Null terminate
+    *p = '\0'; // Null terminate
 }
 
 // Compare two BigInts a and b.
@@ -27,6 +27,7 @@ void setBigIntFromInt(BigInt *num, long long val);
 // Input/Output
 void printBigInt(const BigInt *num);
 void bigIntToString(const BigInt *num, char *str, size_t str_size); // Added size parameter
+size_t bigIntStringLength(const BigInt *num); // Characters bigIntToString needs, excluding '\0'
 
 // Comparison and Checks
 int compareBigInt(const BigInt *a, const BigInt *b);